@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <iomanip>
 #include <cassert>
+#include "../../common/perf_counters.h" // 插桩计数器，-DSM_PERF=0 关闭
 
 using namespace std;
 
@@ -106,6 +107,7 @@ void pkcs7_unpad(vector<uint8_t>& data) {
 // ---------- CBC 模式加解密 ----------
 void SM4_CBC_encrypt(const vector<uint8_t>& plaintext, vector<uint8_t>& ciphertext,
     const uint32_t rk[32], const uint8_t iv[16]) {
+    PERF_SCOPE("sm4_serial", "cbc", plaintext.size(), plaintext.size() / 16 + 1);
     vector<uint8_t> padded = plaintext;
     pkcs7_pad(padded);
     ciphertext.resize(padded.size());
@@ -123,6 +125,7 @@ void SM4_CBC_encrypt(const vector<uint8_t>& plaintext, vector<uint8_t>& cipherte
 
 void SM4_CBC_decrypt(const vector<uint8_t>& ciphertext, vector<uint8_t>& plaintext,
     const uint32_t rk[32], const uint8_t iv[16]) {
+    PERF_SCOPE("sm4_serial", "cbc_decrypt", ciphertext.size(), ciphertext.size() / 16);
     plaintext.resize(ciphertext.size());
     uint8_t block[16], last_ct[16];
     memcpy(last_ct, iv, 16);
@@ -167,5 +170,9 @@ int main() {
     else
         cout << "CBC 解密失败！" << endl;
 
+#if SM_PERF
+    cout << perf::to_json(perf::snapshot()) << endl;
+#endif
+
     return 0;
 }
@@ -4,6 +4,7 @@
 #include <cstring>
 #include <immintrin.h> // SIMD ָ֧
 #include <random>
+#include "../../../common/perf_counters.h" // ׮-DSM_PERF=0 ر
 using namespace std;
 using namespace std::chrono;
 
@@ -67,6 +68,7 @@ void SM4_encrypt_block(const uint8_t in[16], uint8_t out[16], const uint32_t rk[
 
 // ͨܣ鴮У
 void sm4_encrypt_serial(const vector<uint8_t>& in, vector<uint8_t>& out, const uint32_t rk[32]) {
+    PERF_SCOPE("sm4_serial", "ecb", in.size(), in.size() / 16);
     out.resize(in.size());
     for (size_t i = 0; i < in.size(); i += 16)
         SM4_encrypt_block(&in[i], &out[i], rk);
@@ -74,6 +76,7 @@ void sm4_encrypt_serial(const vector<uint8_t>& in, vector<uint8_t>& out, const u
 
 // SIMD Żʹ AVX2  XORԴУ
 void sm4_encrypt_simd(const vector<uint8_t>& in, vector<uint8_t>& out, const uint32_t rk[32]) {
+    PERF_SCOPE_PARALLEL("sm4_simd", "ecb", in.size(), in.size() / 16);
     out.resize(in.size());
 #pragma omp parallel for
     for (int i = 0; i < static_cast<int>(in.size()); i += 16) {
@@ -123,6 +126,10 @@ void benchmark() {
         cout << "ܽһ" << endl;
     else
         cout << "ܽһ" << endl;
+
+#if SM_PERF
+    cout << perf::to_json(perf::snapshot()) << endl;
+#endif
 }
 
 int main() {
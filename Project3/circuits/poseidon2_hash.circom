@@ -1,15 +1,17 @@
 pragma circom 2.1.4;
 
-template Poseidon2HashCheck(n) {
-    signal input in[n];      // 原像
-    signal input hash;       // 公开 Poseidon2 哈希值（来自 JS）
+include "circomlib/poseidon2.circom";
 
-    // 简单输出相等性检查
-    signal computed_hash;
-    computed_hash <== in[0] + in[1];  // 简化为测试加法，你也可以改成别的运算
+template Poseidon2HashCheck() {
+    signal input in[2];      // 原像
+    signal input hash;       // 公开 Poseidon2 哈希值（来自 native/gen_input）
 
-    computed_hash === hash;
+    component hasher = Poseidon2Hash2();
+    hasher.in[0] <== in[0];
+    hasher.in[1] <== in[1];
+
+    hasher.out === hash;
 }
 
-component main = Poseidon2HashCheck(2);
+component main {public [hash]} = Poseidon2HashCheck();
 
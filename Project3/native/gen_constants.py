@@ -0,0 +1,193 @@
+# 生成 Poseidon2 (BN254, t=3, d=5, R_F=8, R_P=56) 轮常量
+# 与 HorizenLabs 参考实现相同的 Grain LFSR 生成方式，输出：
+#   native/poseidon2_constants.h        C++ 规范形式 4x64 limb（小端）
+#   circuits/circomlib/poseidon2.circom 电路模板及同一组常量
+# 用法：python3 native/gen_constants.py   （在 Project3 目录下运行）
+import os
+
+P = 0x30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000001
+N_BITS, T, R_F, R_P = 254, 3, 8, 56
+
+# 参考测试向量：permute([0, 1, 2])
+TEST_VECTOR = [
+    0x0bb61d24daca55eebcb1929a82650f328134334da98ea4f847f760054f4a3033,
+    0x303b6f7c86d043bfcbcc80214f26a30277a15d3f74ca654992defe7ff8d03570,
+    0x1ed25194542b12eef8617361c3ba7c52e660b145994427cc86296242cf766ec8,
+]
+
+
+def grain_lfsr():
+    state = []
+    for value, width in ((1, 2), (0, 4), (N_BITS, 12), (T, 12), (R_F, 10), (R_P, 10), ((1 << 30) - 1, 30)):
+        state += [(value >> (width - 1 - i)) & 1 for i in range(width)]
+
+    def next_bit():
+        b = state[62] ^ state[51] ^ state[38] ^ state[23] ^ state[13] ^ state[0]
+        state.pop(0)
+        state.append(b)
+        return b
+
+    for _ in range(160):
+        next_bit()
+
+    def next_element():
+        while True:
+            v = 0
+            for _ in range(N_BITS):
+                while next_bit() == 0:
+                    next_bit()
+                v = (v << 1) | next_bit()
+            if v < P:
+                return v
+
+    return next_element
+
+
+def round_constants():
+    elem = grain_lfsr()
+    ext, internal = [], []
+    for r in range(R_F + R_P):
+        if R_F // 2 <= r < R_F // 2 + R_P:
+            internal.append(elem())
+        else:
+            ext.append([elem() for _ in range(T)])
+    return ext, internal
+
+
+def permute(state, ext, internal):
+    def m_ext(s):
+        t = sum(s) % P
+        return [(x + t) % P for x in s]
+
+    def m_int(s):
+        t = sum(s) % P
+        return [(s[0] + t) % P, (s[1] + t) % P, (2 * s[2] + t) % P]
+
+    s = m_ext(state)
+    for r in range(R_F // 2):
+        s = m_ext([pow((s[i] + ext[r][i]) % P, 5, P) for i in range(T)])
+    for c in internal:
+        s[0] = pow((s[0] + c) % P, 5, P)
+        s = m_int(s)
+    for r in range(R_F // 2, R_F):
+        s = m_ext([pow((s[i] + ext[r][i]) % P, 5, P) for i in range(T)])
+    return s
+
+
+def limbs(x):
+    return "{ " + ", ".join("0x%016xULL" % ((x >> (64 * i)) & (2**64 - 1)) for i in range(4)) + " }"
+
+
+def write_header(path, ext, internal):
+    out = ["// 由 native/gen_constants.py 生成，请勿手工修改",
+           "// Poseidon2 BN254 t=3 轮常量（规范形式，4x64 limb 小端）",
+           "#pragma once", "", "#include <cstdint>", "", "namespace poseidon2 {", "",
+           "const int kRoundsF = %d;" % R_F, "const int kRoundsP = %d;" % R_P, "",
+           "constexpr uint64_t kRcExternalRaw[kRoundsF][3][4] = {"]
+    for row in ext:
+        out += ["    {"] + ["        " + limbs(x) + "," for x in row] + ["    },"]
+    out += ["};", "", "constexpr uint64_t kRcInternalRaw[kRoundsP][4] = {"]
+    out += ["    " + limbs(x) + "," for x in internal]
+    out += ["};", "", "}  // namespace poseidon2", ""]
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+
+def write_circom(path, ext, internal):
+    ext_rows = ",\n        ".join("[" + ", ".join("0x%064x" % x for x in row) + "]" for row in ext)
+    int_rows = ",\n        ".join("0x%064x" % x for x in internal)
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(CIRCOM_TEMPLATE.format(R_F=R_F, R_P=R_P, half=R_F // 2, ext=ext_rows, internal=int_rows))
+
+
+CIRCOM_TEMPLATE = """pragma circom 2.1.4;
+
+// 由 native/gen_constants.py 生成，请勿手工修改
+// Poseidon2 over BN254, t=3, d=5, R_F={R_F}, R_P={R_P}（与 native/poseidon2.h 一致）
+
+function POSEIDON2_RC_EXT() {{
+    return [
+        {ext}
+    ];
+}}
+
+function POSEIDON2_RC_INT() {{
+    return [
+        {internal}
+    ];
+}}
+
+template Poseidon2Sbox() {{
+    signal input in;
+    signal output out;
+    signal x2;
+    signal x4;
+    x2 <== in * in;
+    x4 <== x2 * x2;
+    out <== x4 * in;
+}}
+
+template Poseidon2Permutation() {{
+    signal input in[3];
+    signal output out[3];
+
+    var rcE[{R_F}][3] = POSEIDON2_RC_EXT();
+    var rcI[{R_P}] = POSEIDON2_RC_INT();
+    component sE[{R_F}][3];
+    component sI[{R_P}];
+    var s[3];
+    var t;
+
+    // 初始外部线性层 M_E = circ(2, 1, 1)
+    t = in[0] + in[1] + in[2];
+    for (var i = 0; i < 3; i++) s[i] = in[i] + t;
+
+    for (var r = 0; r < {R_F}; r++) {{
+        if (r == {half}) {{
+            // 部分轮，M_I = [[2,1,1],[1,2,1],[1,1,3]]
+            for (var k = 0; k < {R_P}; k++) {{
+                sI[k] = Poseidon2Sbox();
+                sI[k].in <== s[0] + rcI[k];
+                s[0] = sI[k].out;
+                t = s[0] + s[1] + s[2];
+                s[0] = s[0] + t;
+                s[1] = s[1] + t;
+                s[2] = 2 * s[2] + t;
+            }}
+        }}
+        for (var i = 0; i < 3; i++) {{
+            sE[r][i] = Poseidon2Sbox();
+            sE[r][i].in <== s[i] + rcE[r][i];
+        }}
+        t = sE[r][0].out + sE[r][1].out + sE[r][2].out;
+        for (var i = 0; i < 3; i++) s[i] = sE[r][i].out + t;
+    }}
+
+    for (var i = 0; i < 3; i++) out[i] <== s[i];
+}}
+
+// 2 输入哈希：state = [0, in[0], in[1]]，输出置换后的 state[0]
+template Poseidon2Hash2() {{
+    signal input in[2];
+    signal output out;
+
+    component perm = Poseidon2Permutation();
+    perm.in[0] <== 0;
+    perm.in[1] <== in[0];
+    perm.in[2] <== in[1];
+    out <== perm.out[0];
+}}
+"""
+
+
+def main():
+    ext, internal = round_constants()
+    assert permute([0, 1, 2], ext, internal) == TEST_VECTOR, "test vector mismatch"
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    write_header(os.path.join(root, "native", "poseidon2_constants.h"), ext, internal)
+    write_circom(os.path.join(root, "circuits", "circomlib", "poseidon2.circom"), ext, internal)
+    print("poseidon2 constants written, test vector ok")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,145 @@
+// Poseidon2 批量哈希，生成 circom 电路输入
+//
+// 用法（在 Project3 目录下运行）：
+//   gen_input                       原像 [1, 2]，写入 input/input.json
+//   gen_input <file|-> [out_dir]    从文件（- 为标准输入）读取原像，每行一对十进制数，
+//                                   以空格或逗号分隔，空行和 # 开头的行忽略；
+//                                   第 i 对写入 out_dir/input_<i>.json（默认 input/batch，目录需已存在）
+// 每个文件格式与 poseidon2_hash.circom 的输入一致：{ "in": [...], "hash": "..." }
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "poseidon2.h"
+
+using namespace std;
+using namespace std::chrono;
+using poseidon2::Fr;
+
+// ---------- 自检 ----------
+bool self_test() {
+    // permute([0, 1, 2]) 参考测试向量
+    const char* expected[3] = {
+        "5297208644449048816064511434384511824916970985131888684874823260532015509555",
+        "21816030159894113985964609355246484851575571273661473159848781012394295965040",
+        "13940986381491601233448981668101586453321811870310341844570924906201623195336" };
+    Fr s[3] = { poseidon2::from_u64(0), poseidon2::from_u64(1), poseidon2::from_u64(2) };
+    poseidon2::permute(s);
+    for (int i = 0; i < 3; ++i)
+        if (poseidon2::to_decimal(s[i]) != expected[i]) return false;
+
+    Fr x = poseidon2::zero();
+    if (!poseidon2::from_decimal(expected[0], x) || !poseidon2::equal(x, s[0])) return false;
+    // p - 1 合法，p 与超过 2^256 的数、空串、非数字字符均应拒绝
+    const char* p_minus_1 =
+        "21888242871839275222246405745257275088548364400416034343698204186575808495616";
+    const char* p = "21888242871839275222246405745257275088548364400416034343698204186575808495617";
+    const char* too_big =
+        "115792089237316195423570985008687907853269984665640564039457584007913129639936";
+    if (!poseidon2::from_decimal(p_minus_1, x) || poseidon2::to_decimal(x) != p_minus_1) return false;
+    if (poseidon2::from_decimal(p, x)) return false;
+    if (poseidon2::from_decimal(too_big, x)) return false;
+    if (poseidon2::from_decimal("", x)) return false;
+    if (poseidon2::from_decimal("12a3", x)) return false;
+    return true;
+}
+
+// 每行一对原像；格式错误时报告行号并返回 false
+bool read_preimages(istream& in, vector<array<Fr, 2>>& out) {
+    string line;
+    for (size_t lineno = 1; getline(in, line); ++lineno) {
+        for (char& c : line)
+            if (c == ',' || c == '\t' || c == '\r') c = ' ';
+        istringstream ss(line);
+        string a, b, extra;
+        if (!(ss >> a) || a[0] == '#') continue;
+        array<Fr, 2> pair;
+        if (!(ss >> b) || (ss >> extra)) {
+            cerr << "第 " << lineno << " 行: 每行需要恰好两个原像" << endl;
+            return false;
+        }
+        if (!poseidon2::from_decimal(a, pair[0]) || !poseidon2::from_decimal(b, pair[1])) {
+            cerr << "第 " << lineno << " 行: 原像必须是小于 p 的十进制整数" << endl;
+            return false;
+        }
+        out.push_back(pair);
+    }
+    return true;
+}
+
+bool write_input(const string& path, const array<Fr, 2>& in, const Fr& h) {
+    ofstream f(path);
+    if (!f) return false;
+    f << "{\n  \"in\": [\n    \"" << poseidon2::to_decimal(in[0]) << "\",\n    \""
+      << poseidon2::to_decimal(in[1]) << "\"\n  ],\n  \"hash\": \""
+      << poseidon2::to_decimal(h) << "\"\n}";
+    return static_cast<bool>(f);
+}
+
+int main(int argc, char** argv) {
+    if (!self_test()) {
+        cerr << "Poseidon2 自检失败" << endl;
+        return 1;
+    }
+
+    vector<array<Fr, 2>> preimages;
+    if (argc < 2) {
+        preimages.push_back({ { poseidon2::from_u64(1), poseidon2::from_u64(2) } });
+    }
+    else {
+        string src = argv[1];
+        bool ok;
+        if (src == "-") {
+            ok = read_preimages(cin, preimages);
+        }
+        else {
+            ifstream f(src);
+            if (!f) {
+                cerr << "无法打开 " << src << endl;
+                return 1;
+            }
+            ok = read_preimages(f, preimages);
+        }
+        if (!ok) return 1;
+        if (preimages.empty()) {
+            cerr << src << " 中没有原像" << endl;
+            return 1;
+        }
+    }
+
+    vector<Fr> hashes;
+    auto t1 = high_resolution_clock::now();
+    poseidon2::hash2_batch(preimages, hashes);
+    auto t2 = high_resolution_clock::now();
+
+    const long long count = static_cast<long long>(preimages.size());
+    if (argc < 2) {
+        if (!write_input("input/input.json", preimages[0], hashes[0])) {
+            cerr << "无法写入 input/input.json" << endl;
+            return 1;
+        }
+        cout << "✅ input.json 生成成功" << endl;
+    }
+    else {
+        string out_dir = argc > 2 ? argv[2] : "input/batch";
+        long long failed = 0;
+#pragma omp parallel for reduction(+:failed)
+        for (long long i = 0; i < count; ++i) {
+            string path = out_dir + "/input_" + to_string(i) + ".json";
+            if (!write_input(path, preimages[i], hashes[i])) ++failed;
+        }
+        if (failed) {
+            cerr << failed << " 个文件写入失败（" << out_dir << " 是否存在？）" << endl;
+            return 1;
+        }
+        cout << "✅ 已生成 " << count << " 个输入文件到 " << out_dir << endl;
+    }
+
+    double ms = duration<double, milli>(t2 - t1).count();
+    cout << "哈希耗时: " << ms << " ms（" << ms * 1000.0 / count << " us/hash）" << endl;
+    return 0;
+}
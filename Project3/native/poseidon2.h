@@ -0,0 +1,269 @@
+// Poseidon2 over BN254 标量域（t=3, d=5, R_F=8, R_P=56）
+// 域元素为 4x64 limb 的 Montgomery 形式，轮常量在编译期转换（constexpr）。
+// 与 circuits/circomlib/poseidon2.circom 中的 Poseidon2Hash2 输出一致。
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "poseidon2_constants.h"
+
+namespace poseidon2 {
+
+// ---------- 64 位基本运算 ----------
+constexpr uint64_t mul_wide(uint64_t a, uint64_t b, uint64_t& hi) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+    hi = static_cast<uint64_t>(r >> 64);
+    return static_cast<uint64_t>(r);
+#else
+    // MSVC 无 __int128，且 _umul128 不能用于常量求值，按 32 位拆分
+    uint64_t a0 = a & 0xffffffff, a1 = a >> 32;
+    uint64_t b0 = b & 0xffffffff, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+    hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return (mid << 32) | (p00 & 0xffffffff);
+#endif
+}
+
+// a + b + carry，carry 为 0/1，返回低 64 位
+constexpr uint64_t adc(uint64_t a, uint64_t b, uint64_t& carry) {
+    uint64_t s = a + b;
+    uint64_t c1 = s < a;
+    uint64_t r = s + carry;
+    carry = c1 | (r < s);
+    return r;
+}
+
+// a - b - borrow，borrow 为 0/1
+constexpr uint64_t sbb(uint64_t a, uint64_t b, uint64_t& borrow) {
+    uint64_t d = a - b;
+    uint64_t b1 = a < b;
+    uint64_t r = d - borrow;
+    borrow = b1 | (d < borrow);
+    return r;
+}
+
+// a * b + c + carry，结果低 64 位返回，高 64 位写回 carry（不会溢出 128 位）
+constexpr uint64_t mac(uint64_t a, uint64_t b, uint64_t c, uint64_t& carry) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = static_cast<unsigned __int128>(a) * b + c + carry;
+    carry = static_cast<uint64_t>(r >> 64);
+    return static_cast<uint64_t>(r);
+#else
+    uint64_t hi = 0;
+    uint64_t lo = mul_wide(a, b, hi);
+    uint64_t k = 0;
+    lo = adc(lo, c, k);
+    hi += k;
+    k = 0;
+    lo = adc(lo, carry, k);
+    carry = hi + k;
+    return lo;
+#endif
+}
+
+// ---------- 域参数 ----------
+// p = 0x30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000001
+constexpr uint64_t kModulus[4] = {
+    0x43e1f593f0000001ULL, 0x2833e84879b97091ULL, 0xb85045b68181585dULL, 0x30644e72e131a029ULL };
+constexpr uint64_t kInv = 0xc2e1f593efffffffULL;  // -p^{-1} mod 2^64
+constexpr uint64_t kR2[4] = {                      // R^2 mod p, R = 2^256
+    0x1bb8e645ae216da7ULL, 0x53fe3ab1e35c59e3ULL, 0x8c49833d53bb8085ULL, 0x0216d0b17f4e44a5ULL };
+
+struct Fr {
+    uint64_t v[4];  // Montgomery 形式，小端 limb
+};
+
+constexpr Fr zero() { return Fr{ { 0, 0, 0, 0 } }; }
+
+// 若 r >= p 则减去 p（p < 2^254，加法/乘法结果至多 < 2p）
+constexpr Fr reduce_once(const uint64_t r[4]) {
+    uint64_t borrow = 0;
+    uint64_t d0 = sbb(r[0], kModulus[0], borrow);
+    uint64_t d1 = sbb(r[1], kModulus[1], borrow);
+    uint64_t d2 = sbb(r[2], kModulus[2], borrow);
+    uint64_t d3 = sbb(r[3], kModulus[3], borrow);
+    return borrow ? Fr{ { r[0], r[1], r[2], r[3] } } : Fr{ { d0, d1, d2, d3 } };
+}
+
+constexpr Fr add(const Fr& a, const Fr& b) {
+    uint64_t carry = 0;
+    uint64_t r[4] = { 0, 0, 0, 0 };
+    for (int i = 0; i < 4; ++i)
+        r[i] = adc(a.v[i], b.v[i], carry);
+    return reduce_once(r);
+}
+
+// Montgomery 乘法，返回 a * b * R^{-1} mod p
+// p 最高 limb < 2^62，可用 no-carry CIOS：中间结果始终放得下 4 个 limb
+constexpr Fr mul(const Fr& a, const Fr& b) {
+    uint64_t t[4] = { 0, 0, 0, 0 };
+    for (int i = 0; i < 4; ++i) {
+        uint64_t A = 0;
+        t[0] = mac(a.v[0], b.v[i], t[0], A);
+        uint64_t m = t[0] * kInv;
+        uint64_t C = 0;
+        mac(m, kModulus[0], t[0], C);
+        for (int j = 1; j < 4; ++j) {
+            t[j] = mac(a.v[j], b.v[i], t[j], A);
+            t[j - 1] = mac(m, kModulus[j], t[j], C);
+        }
+        t[3] = C + A;
+    }
+    return reduce_once(t);
+}
+
+constexpr Fr square(const Fr& a) { return mul(a, a); }
+
+// 规范形式 limb -> Montgomery 形式
+constexpr Fr from_raw(const uint64_t raw[4]) {
+    return mul(Fr{ { raw[0], raw[1], raw[2], raw[3] } }, Fr{ { kR2[0], kR2[1], kR2[2], kR2[3] } });
+}
+
+constexpr Fr from_u64(uint64_t x) {
+    return mul(Fr{ { x, 0, 0, 0 } }, Fr{ { kR2[0], kR2[1], kR2[2], kR2[3] } });
+}
+
+// Montgomery 形式 -> 规范形式 limb
+inline void to_raw(const Fr& a, uint64_t out[4]) {
+    Fr r = mul(a, Fr{ { 1, 0, 0, 0 } });
+    for (int i = 0; i < 4; ++i) out[i] = r.v[i];
+}
+
+inline bool equal(const Fr& a, const Fr& b) {
+    return a.v[0] == b.v[0] && a.v[1] == b.v[1] && a.v[2] == b.v[2] && a.v[3] == b.v[3];
+}
+
+// ---------- 编译期轮常量 ----------
+struct RoundConstants {
+    Fr external[kRoundsF][3];
+    Fr internal[kRoundsP];
+};
+
+constexpr RoundConstants make_round_constants() {
+    RoundConstants rc{};
+    for (int r = 0; r < kRoundsF; ++r)
+        for (int i = 0; i < 3; ++i)
+            rc.external[r][i] = from_raw(kRcExternalRaw[r][i]);
+    for (int r = 0; r < kRoundsP; ++r)
+        rc.internal[r] = from_raw(kRcInternalRaw[r]);
+    return rc;
+}
+
+static constexpr RoundConstants kRc = make_round_constants();
+
+// ---------- 置换 ----------
+inline Fr sbox(const Fr& x) {
+    Fr x2 = square(x);
+    Fr x4 = square(x2);
+    return mul(x4, x);
+}
+
+// M_E = circ(2, 1, 1)
+inline void external_layer(Fr s[3]) {
+    Fr t = add(add(s[0], s[1]), s[2]);
+    s[0] = add(s[0], t);
+    s[1] = add(s[1], t);
+    s[2] = add(s[2], t);
+}
+
+// M_I = [[2,1,1],[1,2,1],[1,1,3]]
+inline void internal_layer(Fr s[3]) {
+    Fr t = add(add(s[0], s[1]), s[2]);
+    s[0] = add(s[0], t);
+    s[1] = add(s[1], t);
+    s[2] = add(add(s[2], s[2]), t);
+}
+
+inline void full_round(Fr s[3], const Fr rc[3]) {
+    for (int i = 0; i < 3; ++i)
+        s[i] = sbox(add(s[i], rc[i]));
+    external_layer(s);
+}
+
+inline void permute(Fr s[3]) {
+    external_layer(s);
+    for (int r = 0; r < kRoundsF / 2; ++r)
+        full_round(s, kRc.external[r]);
+    for (int r = 0; r < kRoundsP; ++r) {
+        s[0] = sbox(add(s[0], kRc.internal[r]));
+        internal_layer(s);
+    }
+    for (int r = kRoundsF / 2; r < kRoundsF; ++r)
+        full_round(s, kRc.external[r]);
+}
+
+// 2 输入哈希：state = [0, a, b]，取置换后的 state[0]
+inline Fr hash2(const Fr& a, const Fr& b) {
+    Fr s[3] = { zero(), a, b };
+    permute(s);
+    return s[0];
+}
+
+// ---------- 批量接口 ----------
+// out[i] = hash2(in[i][0], in[i][1])，启用 OpenMP 时按原像并行
+inline void hash2_batch(const std::vector<std::array<Fr, 2>>& in, std::vector<Fr>& out) {
+    const long long n = static_cast<long long>(in.size());
+    out.resize(in.size());
+#pragma omp parallel for schedule(static)
+    for (long long i = 0; i < n; ++i)
+        out[i] = hash2(in[i][0], in[i][1]);
+}
+
+// ---------- 十进制字符串（snarkjs input.json 格式） ----------
+inline std::string to_decimal(const Fr& a) {
+    uint64_t x[4];
+    to_raw(a, x);
+    std::string digits;
+    while (x[0] | x[1] | x[2] | x[3]) {
+        // 整体除以 10^19，余数按 19 位十进制输出
+        const uint64_t base = 10000000000000000000ULL;
+        uint64_t rem = 0;
+        for (int i = 3; i >= 0; --i) {
+            uint64_t q = 0;
+            for (int bit = 63; bit >= 0; --bit) {
+                uint64_t top = rem >> 63;
+                rem = (rem << 1) | ((x[i] >> bit) & 1);
+                q <<= 1;
+                if (top || rem >= base) {
+                    rem -= base;
+                    q |= 1;
+                }
+            }
+            x[i] = q;
+        }
+        for (int k = 0; k < 19; ++k) {
+            digits.push_back(static_cast<char>('0' + rem % 10));
+            rem /= 10;
+        }
+    }
+    while (digits.size() > 1 && digits.back() == '0') digits.pop_back();
+    if (digits.empty()) digits = "0";
+    return std::string(digits.rbegin(), digits.rend());
+}
+
+// 解析十进制字符串；空串、含非数字字符或数值 >= p 时返回 false，不做取模
+inline bool from_decimal(const std::string& s, Fr& out) {
+    if (s.empty()) return false;
+    uint64_t x[4] = { 0, 0, 0, 0 };
+    for (char c : s) {
+        if (c < '0' || c > '9') return false;
+        uint64_t carry = static_cast<uint64_t>(c - '0');
+        for (int i = 0; i < 4; ++i)
+            x[i] = mac(x[i], 10, 0, carry);
+        if (carry) return false;  // 超过 2^256
+    }
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; ++i)
+        sbb(x[i], kModulus[i], borrow);
+    if (!borrow) return false;  // x >= p
+    out = from_raw(x);
+    return true;
+}
+
+}  // namespace poseidon2
@@ -1,12 +1,15 @@
 #!/bin/bash
 set -e
 
+mkdir -p build input powersoftau proof
+
 echo "🧱 编译电路..."
 circom circuits/poseidon2_hash.circom --r1cs --wasm --sym -o build/ -l node_modules
 
 
-echo "📥 安装输入..."
-node input/gen_input.js
+echo "📥 生成输入（native Poseidon2）..."
+g++ -std=c++14 -O2 -fopenmp native/gen_input.cpp -o build/gen_input
+./build/gen_input
 
 echo "🔑 Powers of Tau 生成..."
 snarkjs powersoftau new bn128 12 powersoftau/pot12_0000.ptau -v
@@ -17,7 +20,7 @@ snarkjs groth16 setup build/poseidon2_hash.r1cs powersoftau/pot12_final.ptau bui
 snarkjs zkey export verificationkey build/circuit.zkey build/verification_key.json
 
 echo "📦 witness..."
-node build/poseidon2_hash_js/generate_witness.js build/poseidon2_hash.wasm input/input.json witness.wtns
+node build/poseidon2_hash_js/generate_witness.js build/poseidon2_hash_js/poseidon2_hash.wasm input/input.json witness.wtns
 
 echo "🪄 prove..."
 snarkjs groth16 prove build/circuit.zkey witness.wtns proof/proof.json proof/public.json
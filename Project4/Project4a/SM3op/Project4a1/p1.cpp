@@ -5,6 +5,7 @@
 #include <cstring>
 #include <iomanip>
 #include <chrono>
+#include "../../../../common/perf_counters.h" // ׮-DSM_PERF=0 ر
 
 using namespace std;
 using namespace std::chrono;
@@ -59,9 +60,15 @@ vector<uint8_t> sm3(bool use_opt, const vector<uint8_t>& msg) {
     vector<uint8_t> padded = padding(msg);
     uint32_t V[8];
     memcpy(V, IV, sizeof(IV));
-    for (size_t i = 0; i < padded.size(); i += 64) {
-        if (use_opt) compress_optimized(V, &padded[i]);
-        else compress_original(V, &padded[i]);
+    if (use_opt) {
+        PERF_SCOPE("sm3_optimized", "hash", msg.size(), padded.size() / 64);
+        for (size_t i = 0; i < padded.size(); i += 64)
+            compress_optimized(V, &padded[i]);
+    }
+    else {
+        PERF_SCOPE("sm3_original", "hash", msg.size(), padded.size() / 64);
+        for (size_t i = 0; i < padded.size(); i += 64)
+            compress_original(V, &padded[i]);
     }
     vector<uint8_t> hash(32);
     for (int i = 0; i < 8; ++i)
@@ -88,6 +95,9 @@ int main() {
     cout << "Żǰƽʱ: " << t_orig << " us\n";
     cout << "Żƽʱ: " << t_opt << " us\n";
     cout << ": " << (t_orig - t_opt) / t_orig * 100.0 << " %\n";
+#if SM_PERF
+    cout << perf::to_json(perf::snapshot()) << endl;
+#endif
     return 0;
 }
 
@@ -0,0 +1,464 @@
+﻿// SM4 / SM3 热路径插桩与性能计数器（header-only）
+//
+// 用法：
+//   PERF_SCOPE("sm4_simd", "ecb", bytes, blocks);   // 放在内核函数开头
+//   backend / mode 必须是字符串字面量：槽位按调用点缓存，运行时选择的名字
+//   会全部记到第一次的槽位上，因此宏用字面量拼接强制编译期检查；
+//   需要按运行时分支区分后端时，在各分支里分别写 PERF_SCOPE。
+//   std::cout << perf::to_json(perf::snapshot());   // 或 perf::to_prometheus(...)
+//
+// 编译期开关：-DSM_PERF=0 时 PERF_SCOPE 展开为空，snapshot() 返回空结果。
+// 硬件计数器：仅 Linux，设置环境变量 SM_PERF_HW=1 后通过 perf_event_open 读取
+//            cycles / instructions / L1D read miss（每次调用多两次 syscall）。
+//            计数器只统计调用线程；内核内部用 OpenMP 分给工作线程时改用
+//            PERF_SCOPE_PARALLEL，该槽位不导出硬件计数（tsc_cycles 仍为墙钟周期）。
+//            PMU 复用时按 time_enabled / time_running 缩放。某个事件只有在该槽位的
+//            每次调用都测到时才导出；没测到的调用计入 hw_missed_calls。
+#pragma once
+
+#ifndef SM_PERF
+#define SM_PERF 1
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if SM_PERF && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define SM_PERF_HW_SUPPORTED 1
+#else
+#define SM_PERF_HW_SUPPORTED 0
+#endif
+
+namespace perf {
+
+const int kMaxSlots = 32;       // backend x mode 组合上限，最后一个槽位留作 overflow
+const int kHistBuckets = 40;    // 第 i 个桶统计 [2^i, 2^(i+1)) 个周期的调用
+const int kHwEvents = 3;        // cycles, instructions, l1d_read_misses
+
+// ---------- 快照结构 ----------
+struct SlotStats {
+    std::string backend;
+    std::string mode;
+    uint64_t calls = 0;
+    uint64_t bytes = 0;
+    uint64_t blocks = 0;
+    uint64_t tsc_cycles = 0;
+    uint64_t hist[kHistBuckets] = {};
+    bool parallel = false;
+    bool hw_valid[kHwEvents] = {};  // hw_calls[e] == calls 时才为 true
+    uint64_t hw[kHwEvents] = {};
+    uint64_t hw_calls[kHwEvents] = {};  // 实际记录了该事件增量的调用次数
+    uint64_t hw_missed = 0;  // 请求了硬件计数却一个事件也没测到的调用次数
+};
+
+// ---------- 基本函数 ----------
+inline uint64_t rdtsc() {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+inline int hist_bucket(uint64_t cycles) {
+    int b = 0;
+#if defined(__GNUC__)
+    if (cycles > 1) b = 63 - __builtin_clzll(cycles);
+#else
+    while (cycles > 1) { cycles >>= 1; ++b; }
+#endif
+    return b < kHistBuckets ? b : kHistBuckets - 1;
+}
+
+// 线程只写自己的计数器，snapshot 在其他线程并发读，因此用 relaxed 原子，
+// 且写端是 load + store 而不是 fetch_add，避免热路径上的 lock 前缀指令。
+inline void bump(std::atomic<uint64_t>& c, uint64_t n) {
+    c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+struct SlotCounters {
+    std::atomic<uint64_t> calls{ 0 }, bytes{ 0 }, blocks{ 0 }, tsc_cycles{ 0 };
+    std::atomic<uint64_t> hist[kHistBuckets] = {};
+    std::atomic<uint64_t> hw[kHwEvents] = {};
+    std::atomic<uint64_t> hw_calls[kHwEvents] = {};
+    std::atomic<uint64_t> hw_missed{ 0 };
+};
+
+// 一次 PERF_FORMAT_GROUP 读数
+struct HwReading {
+    uint64_t enabled = 0;
+    uint64_t running = 0;
+    uint64_t value[kHwEvents] = {};
+};
+
+// ---------- 硬件计数器（perf_event_open） ----------
+struct HwGroup {
+    int fd[kHwEvents] = { -1, -1, -1 };
+    int index[kHwEvents] = { -1, -1, -1 };  // 在 PERF_FORMAT_GROUP 读出结果中的位置
+    int nr = 0;
+    bool tried = false;
+
+#if SM_PERF_HW_SUPPORTED
+    static int open_event(uint32_t type, uint64_t config, int group_fd) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = group_fd == -1 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+            PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+
+    void open() {
+        tried = true;
+        const uint32_t types[kHwEvents] = {
+            PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE };
+        const uint64_t configs[kHwEvents] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) };
+        for (int e = 0; e < kHwEvents; ++e) {
+            fd[e] = open_event(types[e], configs[e], e == 0 ? -1 : fd[0]);
+            if (fd[e] >= 0) index[e] = nr++;
+            else if (e == 0) return;  // 组长打不开则整体放弃
+        }
+        ioctl(fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    // 读出格式：nr, time_enabled, time_running, value[nr]
+    bool read_all(HwReading& out) const {
+        uint64_t buf[3 + kHwEvents];
+        if (fd[0] < 0) return false;
+        if (::read(fd[0], buf, sizeof(uint64_t) * (3 + nr)) <= 0) return false;
+        out.enabled = buf[1];
+        out.running = buf[2];
+        for (int e = 0; e < kHwEvents; ++e)
+            out.value[e] = index[e] >= 0 ? buf[3 + index[e]] : 0;
+        return true;
+    }
+
+    ~HwGroup() {
+        for (int e = kHwEvents - 1; e >= 0; --e)
+            if (fd[e] >= 0) close(fd[e]);
+    }
+#else
+    void open() { tried = true; }
+    bool read_all(HwReading&) const { return false; }
+#endif
+};
+
+inline bool hw_requested() {
+#if SM_PERF_HW_SUPPORTED
+    static const bool on = [] {
+        const char* v = std::getenv("SM_PERF_HW");
+        return v != nullptr && v[0] != '\0' && v[0] != '0';
+    }();
+    return on;
+#else
+    return false;
+#endif
+}
+
+// ---------- 全局注册表 ----------
+struct ThreadCounters;
+
+struct Registry {
+    std::mutex mu;
+    std::string backend[kMaxSlots];
+    std::string mode[kMaxSlots];
+    bool parallel[kMaxSlots] = {};
+    std::atomic<int> nslots{ 0 };
+    std::vector<ThreadCounters*> live;
+    SlotStats retired[kMaxSlots];  // 已退出线程的累计值
+};
+
+inline Registry& registry() {
+    static Registry* r = new Registry();  // 故意不析构，线程退出顺序无关
+    return *r;
+}
+
+struct ThreadCounters {
+    SlotCounters slot[kMaxSlots];
+    HwGroup hw;
+
+    ThreadCounters() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mu);
+        r.live.push_back(this);
+    }
+
+    ~ThreadCounters() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mu);
+        for (int s = 0; s < kMaxSlots; ++s)
+            accumulate(s, r.retired[s]);
+        for (size_t i = 0; i < r.live.size(); ++i) {
+            if (r.live[i] == this) {
+                r.live.erase(r.live.begin() + i);
+                break;
+            }
+        }
+    }
+
+    void accumulate(int s, SlotStats& out) const {
+        const SlotCounters& c = slot[s];
+        out.calls += c.calls.load(std::memory_order_relaxed);
+        out.bytes += c.bytes.load(std::memory_order_relaxed);
+        out.blocks += c.blocks.load(std::memory_order_relaxed);
+        out.tsc_cycles += c.tsc_cycles.load(std::memory_order_relaxed);
+        for (int b = 0; b < kHistBuckets; ++b)
+            out.hist[b] += c.hist[b].load(std::memory_order_relaxed);
+        out.hw_missed += c.hw_missed.load(std::memory_order_relaxed);
+        for (int e = 0; e < kHwEvents; ++e) {
+            out.hw[e] += c.hw[e].load(std::memory_order_relaxed);
+            out.hw_calls[e] += c.hw_calls[e].load(std::memory_order_relaxed);
+        }
+    }
+};
+
+inline ThreadCounters& local() {
+    thread_local ThreadCounters tc;
+    return tc;
+}
+
+// 同一 (backend, mode) 返回同一个槽位；前 kMaxSlots - 1 个组合之外的全部
+// 归入名为 overflow 的最后一个槽位，避免统计被挂到别的组合名下
+inline int slot_id(const char* backend, const char* mode, bool parallel = false) {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mu);
+    int n = r.nslots.load(std::memory_order_relaxed);
+    for (int s = 0; s < n && s < kMaxSlots - 1; ++s)
+        if (r.backend[s] == backend && r.mode[s] == mode) return s;
+    int s = n;
+    if (n >= kMaxSlots - 1) {
+        s = kMaxSlots - 1;
+        if (n == kMaxSlots) return s;
+        backend = "overflow";
+        mode = "overflow";
+        parallel = true;  // 混合了多个组合，硬件计数无从解释
+    }
+    r.backend[s] = backend;
+    r.mode[s] = mode;
+    r.parallel[s] = parallel;
+    r.nslots.store(s + 1, std::memory_order_release);
+    return s;
+}
+
+// ---------- 作用域计时 ----------
+class Scope {
+public:
+    // hw = false：内核会分给其他线程执行，调用线程的硬件计数没有意义，不读取
+    Scope(int slot, uint64_t bytes, uint64_t blocks, bool hw = true)
+        : tc_(local()), slot_(slot), bytes_(bytes), blocks_(blocks),
+          hw_(hw && hw_requested()) {
+        if (hw_) {
+            if (!tc_.hw.tried) tc_.hw.open();
+            hw_ok_ = tc_.hw.read_all(hw_start_);
+        }
+        start_ = rdtsc();
+    }
+
+    ~Scope() {
+        uint64_t cycles = rdtsc() - start_;
+        SlotCounters& c = tc_.slot[slot_];
+        bump(c.calls, 1);
+        bump(c.bytes, bytes_);
+        bump(c.blocks, blocks_);
+        bump(c.tsc_cycles, cycles);
+        bump(c.hist[hist_bucket(cycles)], 1);
+        if (hw_ && !record_hw(c)) bump(c.hw_missed, 1);
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    // 打不开、读失败或计数器组在本次调用中完全未调度时返回 false
+    bool record_hw(SlotCounters& c) const {
+        HwReading hw_end;
+        if (!hw_ok_ || !tc_.hw.read_all(hw_end)) return false;
+        uint64_t enabled = hw_end.enabled - hw_start_.enabled;
+        uint64_t running = hw_end.running - hw_start_.running;
+        if (running == 0) return false;
+        for (int e = 0; e < kHwEvents; ++e) {
+            if (tc_.hw.index[e] < 0) continue;  // 该事件在本线程没打开
+            uint64_t d = hw_end.value[e] - hw_start_.value[e];
+            if (running < enabled)  // 被复用：按实际运行时间比例外推
+                d = static_cast<uint64_t>(static_cast<double>(d) * enabled / running);
+            bump(c.hw[e], d);
+            bump(c.hw_calls[e], 1);
+        }
+        return true;
+    }
+
+    ThreadCounters& tc_;
+    int slot_;
+    uint64_t bytes_, blocks_;
+    uint64_t start_ = 0;
+    bool hw_;
+    bool hw_ok_ = false;
+    HwReading hw_start_;
+};
+
+// ---------- 快照与导出 ----------
+inline std::vector<SlotStats> snapshot() {
+    std::vector<SlotStats> out;
+#if SM_PERF
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mu);
+    int n = r.nslots.load(std::memory_order_acquire);
+    for (int s = 0; s < n; ++s) {
+        SlotStats st = r.retired[s];
+        st.backend = r.backend[s];
+        st.mode = r.mode[s];
+        st.parallel = r.parallel[s];
+        for (ThreadCounters* tc : r.live)
+            tc->accumulate(s, st);
+        for (int e = 0; e < kHwEvents; ++e)
+            st.hw_valid[e] = !st.parallel && st.hw_calls[e] != 0 && st.hw_calls[e] == st.calls;
+        if (st.calls != 0) out.push_back(st);
+    }
+#endif
+    return out;
+}
+
+inline const char* hw_name(int e) {
+    static const char* names[kHwEvents] = { "cycles", "instructions", "l1d_read_misses" };
+    return names[e];
+}
+
+inline std::string to_json(const std::vector<SlotStats>& snap) {
+    std::ostringstream os;
+    os << "{\"slots\":[";
+    for (size_t i = 0; i < snap.size(); ++i) {
+        const SlotStats& s = snap[i];
+        if (i) os << ",";
+        os << "{\"backend\":\"" << s.backend << "\",\"mode\":\"" << s.mode << "\""
+           << ",\"calls\":" << s.calls << ",\"bytes\":" << s.bytes
+           << ",\"blocks\":" << s.blocks << ",\"tsc_cycles\":" << s.tsc_cycles;
+        if (s.parallel) os << ",\"parallel\":true";  // 无硬件计数
+        if (s.hw_missed) os << ",\"hw_missed_calls\":" << s.hw_missed;
+        if (s.bytes)
+            os << ",\"tsc_cycles_per_byte\":" << static_cast<double>(s.tsc_cycles) / s.bytes;
+        // 直方图只输出非空桶，le 为桶上界（含）
+        os << ",\"tsc_histogram\":[";
+        bool first = true;
+        for (int b = 0; b < kHistBuckets; ++b) {
+            if (!s.hist[b]) continue;
+            os << (first ? "" : ",") << "{\"le\":" << ((2ULL << b) - 1)
+               << ",\"count\":" << s.hist[b] << "}";
+            first = false;
+        }
+        os << "]";
+        first = true;
+        for (int e = 0; e < kHwEvents; ++e) {
+            if (!s.hw_valid[e]) continue;
+            os << (first ? ",\"hw\":{" : ",") << "\"" << hw_name(e) << "\":" << s.hw[e];
+            first = false;
+        }
+        if (!first) os << "}";
+        // 测到的调用次数，便于看出哪些事件只覆盖了部分调用
+        first = true;
+        for (int e = 0; e < kHwEvents; ++e) {
+            if (!s.hw_calls[e]) continue;
+            os << (first ? ",\"hw_calls\":{" : ",") << "\"" << hw_name(e) << "\":" << s.hw_calls[e];
+            first = false;
+        }
+        if (!first) os << "}";
+        os << "}";
+    }
+    os << "]}";
+    return os.str();
+}
+
+inline std::string to_prometheus(const std::vector<SlotStats>& snap) {
+    std::ostringstream os;
+    auto labels = [](const SlotStats& s) {
+        return "backend=\"" + s.backend + "\",mode=\"" + s.mode + "\"";
+    };
+    auto counter = [&](const char* name, const char* help, uint64_t SlotStats::*field) {
+        os << "# HELP " << name << " " << help << "\n# TYPE " << name << " counter\n";
+        for (const SlotStats& s : snap)
+            os << name << "{" << labels(s) << "} " << s.*field << "\n";
+    };
+    counter("sm_kernel_calls_total", "Kernel invocations.", &SlotStats::calls);
+    counter("sm_kernel_bytes_total", "Bytes processed.", &SlotStats::bytes);
+    counter("sm_kernel_blocks_total", "Blocks processed.", &SlotStats::blocks);
+
+    const char* h = "sm_kernel_call_tsc_cycles";
+    os << "# HELP " << h << " TSC cycles per kernel invocation.\n# TYPE " << h << " histogram\n";
+    for (const SlotStats& s : snap) {
+        uint64_t cum = 0;
+        for (int b = 0; b < kHistBuckets - 1; ++b) {
+            cum += s.hist[b];
+            os << h << "_bucket{" << labels(s) << ",le=\"" << ((2ULL << b) - 1) << "\"} "
+               << cum << "\n";
+        }
+        // +Inf / _count 由桶计数推出，快照与正在进行的调用并发时也保持单调
+        uint64_t total = cum + s.hist[kHistBuckets - 1];
+        os << h << "_bucket{" << labels(s) << ",le=\"+Inf\"} " << total << "\n";
+        os << h << "_sum{" << labels(s) << "} " << s.tsc_cycles << "\n";
+        os << h << "_count{" << labels(s) << "} " << total << "\n";
+    }
+
+    for (int e = 0; e < kHwEvents; ++e) {
+        bool any = false;
+        for (const SlotStats& s : snap) any = any || s.hw_valid[e];
+        if (!any) continue;
+        std::string name = std::string("sm_kernel_hw_") + hw_name(e) + "_total";
+        os << "# HELP " << name << " perf_event " << hw_name(e) << " inside kernels.\n"
+           << "# TYPE " << name << " counter\n";
+        for (const SlotStats& s : snap)
+            if (s.hw_valid[e]) os << name << "{" << labels(s) << "} " << s.hw[e] << "\n";
+    }
+    return os.str();
+}
+
+}  // namespace perf
+
+// ---------- 插桩宏 ----------
+#define PERF_CAT_(a, b) a##b
+#define PERF_CAT(a, b) PERF_CAT_(a, b)
+
+#if SM_PERF
+// "" x "" 拼接要求 backend / mode 为字符串字面量，运行时值会编译失败
+#define PERF_SCOPE(backend, mode, bytes, blocks)                                         \
+    static const int PERF_CAT(perf_slot_, __LINE__) =                                    \
+        ::perf::slot_id("" backend "", "" mode "");                                      \
+    ::perf::Scope PERF_CAT(perf_scope_, __LINE__)(PERF_CAT(perf_slot_, __LINE__),        \
+                                                  (bytes), (blocks))
+// 内核内部使用 OpenMP 等多线程时使用：只记录墙钟周期，不读取硬件计数器
+#define PERF_SCOPE_PARALLEL(backend, mode, bytes, blocks)                                \
+    static const int PERF_CAT(perf_slot_, __LINE__) =                                    \
+        ::perf::slot_id("" backend "", "" mode "", true);                                \
+    ::perf::Scope PERF_CAT(perf_scope_, __LINE__)(PERF_CAT(perf_slot_, __LINE__),        \
+                                                  (bytes), (blocks), false)
+#else
+#define PERF_SCOPE(backend, mode, bytes, blocks) ((void)0)
+#define PERF_SCOPE_PARALLEL(backend, mode, bytes, blocks) ((void)0)
+#endif